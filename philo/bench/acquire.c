@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   acquire.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: loda-sil <loda-sil@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:10:00 by loda-sil          #+#    #+#             */
+/*   Updated: 2026/10/19 15:10:00 by loda-sil         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+static void	pick_forks(t_worker *worker, t_slot **first, t_slot **second)
+{
+	t_bench	*bench;
+	t_slot	*left;
+	t_slot	*right;
+
+	bench = worker->bench;
+	left = &bench->slots[worker->id];
+	right = &bench->slots[(worker->id + 1) % bench->num_threads];
+	*first = right;
+	*second = left;
+	if ((worker->id + 1) % 2 == 0)
+	{
+		*first = left;
+		*second = right;
+	}
+}
+
+static void	record_handoff(t_worker *worker, t_slot *slot, long start)
+{
+	if (slot->released <= start)
+		return ;
+	worker->samples[worker->num_samples % MAX_SAMPLES] = now_ns()
+		- slot->released;
+	worker->num_samples++;
+}
+
+static void	take_both(t_slot *first, t_slot *second)
+{
+	int	backoff;
+	int	spins;
+	int	i;
+
+	backoff = 1;
+	spins = 0;
+	while (1)
+	{
+		if (pthread_mutex_trylock(&first->lock.mutex) == 0)
+		{
+			if (pthread_mutex_trylock(&second->lock.mutex) == 0)
+				return ;
+			pthread_mutex_unlock(&first->lock.mutex);
+		}
+		i = 0;
+		while (i++ < backoff)
+			spin_relax(&spins);
+		if (backoff < 1024)
+			backoff *= 2;
+	}
+}
+
+void	acquire_pair(t_worker *worker)
+{
+	const t_strategy	*strategy;
+	t_slot				*first;
+	t_slot				*second;
+	long				start;
+
+	strategy = worker->bench->strategy;
+	pick_forks(worker, &first, &second);
+	start = now_ns();
+	if (strategy->try_both)
+	{
+		take_both(first, second);
+		record_handoff(worker, first, start);
+	}
+	else
+	{
+		strategy->lock(&first->lock, &worker->nodes[0]);
+		record_handoff(worker, first, start);
+		start = now_ns();
+		strategy->lock(&second->lock, &worker->nodes[1]);
+	}
+	record_handoff(worker, second, start);
+}
+
+void	release_pair(t_worker *worker)
+{
+	const t_strategy	*strategy;
+	t_slot				*first;
+	t_slot				*second;
+
+	strategy = worker->bench->strategy;
+	pick_forks(worker, &first, &second);
+	second->released = now_ns();
+	strategy->unlock(&second->lock, &worker->nodes[1]);
+	first->released = now_ns();
+	strategy->unlock(&first->lock, &worker->nodes[0]);
+}
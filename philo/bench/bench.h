@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: loda-sil <loda-sil@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:10:00 by loda-sil          #+#    #+#             */
+/*   Updated: 2026/10/19 15:10:00 by loda-sil         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BENCH_H
+# define BENCH_H
+
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include <unistd.h>
+# include <time.h>
+# include <sched.h>
+# include <pthread.h>
+# include <sys/syscall.h>
+# include <linux/futex.h>
+
+# define MAX_SAMPLES 65536
+# define SPIN_LIMIT 100
+# define CS_WORK 64
+# define THINK_WORK 256
+# define MAX_COUNTS 32
+# define MAX_THREADS 1024
+# define DEFAULT_COUNTS "2,3,4,5,7,8,16"
+
+typedef struct s_ticket
+{
+	unsigned int	next;
+	unsigned int	serving;
+}	t_ticket;
+
+typedef struct s_mcs_node
+{
+	struct s_mcs_node	*next;
+	int					locked;
+}	t_mcs_node;
+
+typedef union u_lock
+{
+	pthread_mutex_t	mutex;
+	t_ticket		ticket;
+	t_mcs_node		*mcs_tail;
+	int				futex;
+}	t_lock;
+
+typedef struct s_slot
+{
+	t_lock	lock;
+	long	released;
+}	__attribute__((aligned(64)))	t_slot;
+
+typedef struct s_strategy
+{
+	char	*name;
+	int		(*init)(t_lock *lock);
+	void	(*lock)(t_lock *lock, t_mcs_node *node);
+	void	(*unlock)(t_lock *lock, t_mcs_node *node);
+	void	(*destroy)(t_lock *lock);
+	int		try_both;
+}	t_strategy;
+
+typedef struct s_worker
+{
+	int				id;
+	pthread_t		thread;
+	struct s_bench	*bench;
+	long			acquisitions;
+	long			*samples;
+	long			num_samples;
+	t_mcs_node		nodes[2];
+}	t_worker;
+
+typedef struct s_bench
+{
+	const t_strategy	*strategy;
+	int					num_threads;
+	long				duration_ms;
+	t_slot				*slots;
+	t_worker			*workers;
+	int					ready;
+	int					go;
+	int					stop;
+	long				elapsed_ns;
+}	t_bench;
+
+// main.c
+long	now_ns(void);
+
+// suite.c
+void	run_suite(t_bench *bench, int *counts, int num_counts);
+
+// runner.c
+int		run_bench(t_bench *bench);
+
+// worker.c
+int		start_workers(t_bench *bench);
+
+// acquire.c
+void	acquire_pair(t_worker *worker);
+void	release_pair(t_worker *worker);
+
+// mutex_lock.c
+int		mx_init(t_lock *lock);
+int		mx_init_adaptive(t_lock *lock);
+void	mx_lock(t_lock *lock, t_mcs_node *node);
+void	mx_unlock(t_lock *lock, t_mcs_node *node);
+void	mx_destroy(t_lock *lock);
+
+// spin_lock.c
+void	spin_relax(int *spins);
+void	ticket_lock(t_lock *lock, t_mcs_node *node);
+void	ticket_unlock(t_lock *lock, t_mcs_node *node);
+void	mcs_lock(t_lock *lock, t_mcs_node *node);
+void	mcs_unlock(t_lock *lock, t_mcs_node *node);
+
+// futex_lock.c
+int		zero_init(t_lock *lock);
+void	futex_lock(t_lock *lock, t_mcs_node *node);
+void	futex_unlock(t_lock *lock, t_mcs_node *node);
+
+// stats.c
+void	report(t_bench *bench);
+
+#endif
@@ -0,0 +1,65 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   futex_lock.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: loda-sil <loda-sil@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:10:00 by loda-sil          #+#    #+#             */
+/*   Updated: 2026/10/19 15:10:00 by loda-sil         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+int	zero_init(t_lock *lock)
+{
+	memset(lock, 0, sizeof(t_lock));
+	return (0);
+}
+
+static void	sys_futex(int *addr, int op, int val)
+{
+	syscall(SYS_futex, addr, op, val, NULL, NULL, 0);
+}
+
+/*
+** 0 = unlocked, 1 = locked, 2 = locked with possible sleepers.
+** Spin briefly on the uncontended transition before parking.
+*/
+void	futex_lock(t_lock *lock, t_mcs_node *node)
+{
+	int	expected;
+	int	spins;
+	int	state;
+
+	(void)node;
+	spins = 0;
+	while (spins < SPIN_LIMIT)
+	{
+		expected = 0;
+		if (__atomic_compare_exchange_n(&lock->futex, &expected, 1, 0,
+				__ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+			return ;
+		spins++;
+#if defined(__x86_64__) || defined(__i386__)
+		__builtin_ia32_pause();
+#endif
+	}
+	state = __atomic_exchange_n(&lock->futex, 2, __ATOMIC_ACQUIRE);
+	while (state != 0)
+	{
+		sys_futex(&lock->futex, FUTEX_WAIT_PRIVATE, 2);
+		state = __atomic_exchange_n(&lock->futex, 2, __ATOMIC_ACQUIRE);
+	}
+}
+
+void	futex_unlock(t_lock *lock, t_mcs_node *node)
+{
+	(void)node;
+	if (__atomic_fetch_sub(&lock->futex, 1, __ATOMIC_RELEASE) != 1)
+	{
+		__atomic_store_n(&lock->futex, 0, __ATOMIC_RELEASE);
+		sys_futex(&lock->futex, FUTEX_WAKE_PRIVATE, 1);
+	}
+}
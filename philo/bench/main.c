@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   main.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: loda-sil <loda-sil@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:10:00 by loda-sil          #+#    #+#             */
+/*   Updated: 2026/10/19 15:10:00 by loda-sil         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+long	now_ns(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000000000L + ts.tv_nsec);
+}
+
+static void	print_header(void)
+{
+	printf("%-16s %7s %12s %9s %9s %9s %10s %9s\n", "strategy", "threads",
+		"acq/s", "p50 ns", "p90 ns", "p99 ns", "p99.9 ns", "max/min");
+}
+
+static int	parse_counts(char *list, int *counts)
+{
+	char	*end;
+	long	value;
+	int		n;
+
+	n = 0;
+	while (n < MAX_COUNTS)
+	{
+		value = strtol(list, &end, 10);
+		if (end == list || value < 2 || value > MAX_THREADS)
+			return (0);
+		counts[n++] = value;
+		if (*end == '\0')
+			return (n);
+		if (*end != ',')
+			return (0);
+		list = end + 1;
+	}
+	return (0);
+}
+
+static int	parse_args(int argc, char **argv, long *duration, int *counts)
+{
+	*duration = 200;
+	if (argc > 3)
+		return (0);
+	if (argc > 1)
+		*duration = atol(argv[1]);
+	if (*duration <= 0)
+		return (0);
+	if (argc > 2)
+		return (parse_counts(argv[2], counts));
+	return (parse_counts(DEFAULT_COUNTS, counts));
+}
+
+int	main(int argc, char **argv)
+{
+	t_bench	bench;
+	int		counts[MAX_COUNTS];
+	int		num_counts;
+
+	num_counts = parse_args(argc, argv, &bench.duration_ms, counts);
+	if (num_counts == 0)
+	{
+		printf("Usage: ./fork_bench [duration_ms] [threads,...]\n");
+		return (1);
+	}
+	print_header();
+	run_suite(&bench, counts, num_counts);
+	return (0);
+}
@@ -0,0 +1,50 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mutex_lock.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: loda-sil <loda-sil@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:10:00 by loda-sil          #+#    #+#             */
+/*   Updated: 2026/10/19 15:10:00 by loda-sil         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+int	mx_init(t_lock *lock)
+{
+	return (pthread_mutex_init(&lock->mutex, NULL));
+}
+
+int	mx_init_adaptive(t_lock *lock)
+{
+	pthread_mutexattr_t	attr;
+	int					ret;
+
+	if (pthread_mutexattr_init(&attr) != 0)
+		return (1);
+#if defined(PTHREAD_ADAPTIVE_MUTEX_INITIALIZER_NP)
+	pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_ADAPTIVE_NP);
+#endif
+	ret = pthread_mutex_init(&lock->mutex, &attr);
+	pthread_mutexattr_destroy(&attr);
+	return (ret);
+}
+
+void	mx_lock(t_lock *lock, t_mcs_node *node)
+{
+	(void)node;
+	pthread_mutex_lock(&lock->mutex);
+}
+
+void	mx_unlock(t_lock *lock, t_mcs_node *node)
+{
+	(void)node;
+	pthread_mutex_unlock(&lock->mutex);
+}
+
+void	mx_destroy(t_lock *lock)
+{
+	pthread_mutex_destroy(&lock->mutex);
+}
@@ -0,0 +1,82 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   runner.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: loda-sil <loda-sil@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:10:00 by loda-sil          #+#    #+#             */
+/*   Updated: 2026/10/19 15:10:00 by loda-sil         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+static int	setup(t_bench *bench)
+{
+	int	i;
+
+	bench->ready = 0;
+	bench->slots = aligned_alloc(64, sizeof(t_slot) * bench->num_threads);
+	bench->workers = calloc(bench->num_threads, sizeof(t_worker));
+	if (!bench->slots || !bench->workers)
+		return (0);
+	i = 0;
+	while (i < bench->num_threads)
+	{
+		bench->slots[i].released = 0;
+		if (bench->strategy->init(&bench->slots[i].lock) != 0)
+			return (0);
+		bench->ready++;
+		bench->workers[i].id = i;
+		bench->workers[i].bench = bench;
+		bench->workers[i].samples = malloc(sizeof(long) * MAX_SAMPLES);
+		if (!bench->workers[i].samples)
+			return (0);
+		i++;
+	}
+	return (1);
+}
+
+static void	teardown(t_bench *bench)
+{
+	int	i;
+
+	i = 0;
+	while (bench->workers && i < bench->num_threads)
+	{
+		if (i < bench->ready && bench->strategy->destroy)
+			bench->strategy->destroy(&bench->slots[i].lock);
+		free(bench->workers[i].samples);
+		i++;
+	}
+	free(bench->workers);
+	free(bench->slots);
+}
+
+int	run_bench(t_bench *bench)
+{
+	int		started;
+	int		ok;
+	long	start;
+
+	bench->go = 0;
+	bench->stop = 0;
+	started = 0;
+	ok = setup(bench);
+	if (ok)
+		started = start_workers(bench);
+	ok = (ok && started == bench->num_threads);
+	start = now_ns();
+	__atomic_store_n(&bench->go, 1, __ATOMIC_RELEASE);
+	if (ok)
+		usleep(bench->duration_ms * 1000);
+	__atomic_store_n(&bench->stop, 1, __ATOMIC_RELAXED);
+	bench->elapsed_ns = now_ns() - start;
+	while (--started >= 0)
+		pthread_join(bench->workers[started].thread, NULL);
+	if (ok)
+		report(bench);
+	teardown(bench);
+	return (ok);
+}
@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spin_lock.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: loda-sil <loda-sil@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:10:00 by loda-sil          #+#    #+#             */
+/*   Updated: 2026/10/19 15:10:00 by loda-sil         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+void	spin_relax(int *spins)
+{
+	if (++(*spins) % SPIN_LIMIT == 0)
+	{
+		sched_yield();
+		return ;
+	}
+#if defined(__x86_64__) || defined(__i386__)
+	__builtin_ia32_pause();
+#endif
+}
+
+void	ticket_lock(t_lock *lock, t_mcs_node *node)
+{
+	unsigned int	ticket;
+	int				spins;
+
+	(void)node;
+	ticket = __atomic_fetch_add(&lock->ticket.next, 1, __ATOMIC_RELAXED);
+	spins = 0;
+	while (__atomic_load_n(&lock->ticket.serving, __ATOMIC_ACQUIRE) != ticket)
+		spin_relax(&spins);
+}
+
+void	ticket_unlock(t_lock *lock, t_mcs_node *node)
+{
+	(void)node;
+	__atomic_store_n(&lock->ticket.serving, lock->ticket.serving + 1,
+		__ATOMIC_RELEASE);
+}
+
+void	mcs_lock(t_lock *lock, t_mcs_node *node)
+{
+	t_mcs_node	*prev;
+	int			spins;
+
+	node->next = NULL;
+	node->locked = 1;
+	prev = __atomic_exchange_n(&lock->mcs_tail, node, __ATOMIC_ACQ_REL);
+	if (!prev)
+		return ;
+	__atomic_store_n(&prev->next, node, __ATOMIC_RELEASE);
+	spins = 0;
+	while (__atomic_load_n(&node->locked, __ATOMIC_ACQUIRE))
+		spin_relax(&spins);
+}
+
+void	mcs_unlock(t_lock *lock, t_mcs_node *node)
+{
+	t_mcs_node	*next;
+	t_mcs_node	*expected;
+	int			spins;
+
+	next = __atomic_load_n(&node->next, __ATOMIC_ACQUIRE);
+	if (!next)
+	{
+		expected = node;
+		if (__atomic_compare_exchange_n(&lock->mcs_tail, &expected, NULL, 0,
+				__ATOMIC_RELEASE, __ATOMIC_RELAXED))
+			return ;
+		spins = 0;
+		next = __atomic_load_n(&node->next, __ATOMIC_ACQUIRE);
+		while (!next)
+		{
+			spin_relax(&spins);
+			next = __atomic_load_n(&node->next, __ATOMIC_ACQUIRE);
+		}
+	}
+	__atomic_store_n(&next->locked, 0, __ATOMIC_RELEASE);
+}
@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: loda-sil <loda-sil@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:10:00 by loda-sil          #+#    #+#             */
+/*   Updated: 2026/10/19 15:10:00 by loda-sil         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+static int	cmp_long(const void *a, const void *b)
+{
+	long	x;
+	long	y;
+
+	x = *(const long *)a;
+	y = *(const long *)b;
+	return ((x > y) - (x < y));
+}
+
+static long	kept_samples(t_worker *worker)
+{
+	if (worker->num_samples > MAX_SAMPLES)
+		return (MAX_SAMPLES);
+	return (worker->num_samples);
+}
+
+static long	gather(t_bench *bench, long **all)
+{
+	long	total;
+	int		i;
+
+	total = 0;
+	i = 0;
+	while (i < bench->num_threads)
+		total += kept_samples(&bench->workers[i++]);
+	*all = malloc(sizeof(long) * (total + 1));
+	if (!*all)
+		return (0);
+	total = 0;
+	i = 0;
+	while (i < bench->num_threads)
+	{
+		memcpy(*all + total, bench->workers[i].samples,
+			sizeof(long) * kept_samples(&bench->workers[i]));
+		total += kept_samples(&bench->workers[i]);
+		i++;
+	}
+	qsort(*all, total, sizeof(long), cmp_long);
+	return (total);
+}
+
+static double	fairness(t_bench *bench, long *total)
+{
+	long	max;
+	long	min;
+	long	acq;
+	int		i;
+
+	*total = 0;
+	max = 0;
+	min = -1;
+	i = 0;
+	while (i < bench->num_threads)
+	{
+		acq = bench->workers[i].acquisitions;
+		*total += acq;
+		if (acq > max)
+			max = acq;
+		if (min < 0 || acq < min)
+			min = acq;
+		i++;
+	}
+	if (min <= 0)
+		return (-1);
+	return ((double)max / min);
+}
+
+void	report(t_bench *bench)
+{
+	long	*all;
+	long	count;
+	long	total;
+	double	fair;
+
+	fair = fairness(bench, &total);
+	count = gather(bench, &all);
+	printf("%-16s %7d %12.0f", bench->strategy->name, bench->num_threads,
+		total * 1e9 / bench->elapsed_ns);
+	if (count > 0)
+		printf(" %9ld %9ld %9ld %10ld", all[(count - 1) * 500 / 1000],
+			all[(count - 1) * 900 / 1000], all[(count - 1) * 990 / 1000],
+			all[(count - 1) * 999 / 1000]);
+	else
+		printf(" %9s %9s %9s %10s", "-", "-", "-", "-");
+	if (fair > 0)
+		printf(" %9.2f\n", fair);
+	else
+		printf(" %9s\n", "inf");
+	free(all);
+}
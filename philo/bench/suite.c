@@ -0,0 +1,43 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   suite.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: loda-sil <loda-sil@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:05:00 by loda-sil          #+#    #+#             */
+/*   Updated: 2026/10/19 19:05:00 by loda-sil         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+static const t_strategy	g_strategies[] = {
+{"mutex", mx_init, mx_lock, mx_unlock, mx_destroy, 0},
+{"mutex_adaptive", mx_init_adaptive, mx_lock, mx_unlock, mx_destroy, 0},
+{"ticket", zero_init, ticket_lock, ticket_unlock, NULL, 0},
+{"mcs", zero_init, mcs_lock, mcs_unlock, NULL, 0},
+{"futex_spin_park", zero_init, futex_lock, futex_unlock, NULL, 0},
+{"trylock_backoff", mx_init, mx_lock, mx_unlock, mx_destroy, 1},
+{NULL, NULL, NULL, NULL, NULL, 0}
+};
+
+void	run_suite(t_bench *bench, int *counts, int num_counts)
+{
+	int	s;
+	int	c;
+
+	s = 0;
+	while (g_strategies[s].name)
+	{
+		bench->strategy = &g_strategies[s];
+		c = 0;
+		while (c < num_counts)
+		{
+			bench->num_threads = counts[c++];
+			if (!run_bench(bench))
+				printf("Error: %s setup failed\n", g_strategies[s].name);
+		}
+		s++;
+	}
+}
@@ -0,0 +1,59 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   worker.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: loda-sil <loda-sil@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:05:00 by loda-sil          #+#    #+#             */
+/*   Updated: 2026/10/19 19:05:00 by loda-sil         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+static void	busy_work(int iterations)
+{
+	volatile int	sink;
+	int				i;
+
+	sink = 0;
+	i = 0;
+	while (i < iterations)
+		sink += i++;
+}
+
+static void	*worker_routine(void *arg)
+{
+	t_worker	*worker;
+	int			spins;
+
+	worker = (t_worker *)arg;
+	spins = 0;
+	while (!__atomic_load_n(&worker->bench->go, __ATOMIC_ACQUIRE))
+		spin_relax(&spins);
+	while (!__atomic_load_n(&worker->bench->stop, __ATOMIC_RELAXED))
+	{
+		acquire_pair(worker);
+		worker->acquisitions++;
+		busy_work(CS_WORK);
+		release_pair(worker);
+		busy_work(THINK_WORK);
+	}
+	return (NULL);
+}
+
+int	start_workers(t_bench *bench)
+{
+	int	i;
+
+	i = 0;
+	while (i < bench->num_threads)
+	{
+		if (pthread_create(&bench->workers[i].thread, NULL,
+				worker_routine, &bench->workers[i]) != 0)
+			return (i);
+		i++;
+	}
+	return (i);
+}
@@ -19,13 +19,67 @@
 # include <unistd.h>
 # include <sys/time.h>
 # include <pthread.h>
+# include <errno.h>
+# include <sys/mman.h>
+# include <sys/wait.h>
+# include <sys/syscall.h>
+# include <linux/io_uring.h>
 
 # define INT_MAX 2147483647
+# define SINK_SIZE 65536
+# define LINE_SIZE 64
+# define TRACE_OFF 0
+# define TRACE_RECORD 1
+# define TRACE_REPLAY 2
+# define FORK_LEFT 0
+# define FORK_RIGHT 1
+
+typedef struct s_fork_log
+{
+	unsigned char	*bits;
+	size_t			count;
+	size_t			cap;
+	size_t			cursor;
+	int				failed;
+}	t_fork_log;
+
+typedef struct s_uring
+{
+	int					fd;
+	void				*sq_ring;
+	size_t				sq_size;
+	void				*cq_ring;
+	size_t				cq_size;
+	struct io_uring_sqe	*sqes;
+	size_t				sqes_size;
+	unsigned int		*sq_tail;
+	unsigned int		*sq_mask;
+	unsigned int		*sq_array;
+	unsigned int		*cq_head;
+	unsigned int		*cq_tail;
+	unsigned int		*cq_mask;
+	struct io_uring_cqe	*cqes;
+}	t_uring;
+
+typedef struct s_sink
+{
+	char			buf[2][SINK_SIZE + LINE_SIZE];
+	size_t			len[2];
+	long			dropped;
+	t_uring			ring;
+	int				active;
+	int				writing;
+	int				stop;
+	pthread_cond_t	ready;
+	pthread_cond_t	drained;
+	pthread_t		thread;
+}	t_sink;
 
 typedef struct s_philo
 {
 	int				id;
 	pthread_t		thread;
+	pid_t			pid;
 	long			last_meal_time;
 	int				meals_eaten;
 	pthread_mutex_t	meal_mutex;
@@ -47,6 +101,11 @@ typedef struct s_data
 	t_philo			*philos;
 	int				all_ate_flag;
 	pthread_mutex_t	meal_check_mutex;
+	t_sink			sink;
+	int				trace_mode;
+	char			*trace_path;
+	t_fork_log		*logs;
+	int				shared;
 }	t_data;
 
 // init.c
@@ -81,8 +140,50 @@ void	smart_sleep(long milliseconds);
 void	print_status(t_philo *philo, char *status);
 int		error_exit(char *msg);
 
+// sink.c
+int		sink_init(t_data *data);
+
+// uring.c
+int		uring_init(t_uring *ring);
+ssize_t	uring_write(t_uring *ring, char *buf, size_t len);
+void	uring_destroy(t_uring *ring);
+
+// sink_utils.c
+int		build_line(char *line, long timestamp, int id, char *status);
+void	sink_append(t_data *data, char *line, int len, int reserved);
+void	sink_flush(t_data *data);
+void	sink_destroy(t_data *data);
+
+// trace.c
+int		trace_init(t_data *data);
+void	trace_free(t_data *data);
+
+// trace_save.c
+int		trace_save(t_data *data);
+
+// trace_fork.c
+void	lock_fork(t_philo *philo, int fork, int side);
+
+// mutex.c
+int		mutex_init(t_data *data, pthread_mutex_t *mutex);
+int		cond_init(t_data *data, pthread_cond_t *cond);
+void	mutex_lock(pthread_mutex_t *mutex);
+void	cond_wait(pthread_cond_t *cond, pthread_mutex_t *mutex);
+
+// shared.c
+t_data	*table_create(t_data *parsed);
+void	table_release(t_data *data);
+void	*table_alloc(t_data *data, size_t size);
+void	table_free(t_data *data, void *ptr, size_t size);
+
+// threads.c
+int		run_threads(t_data *data);
+
+// process.c
+int		run_processes(t_data *data);
+
 // cleanup.c
-void	cleanup(t_data *data);
+int		cleanup(t_data *data);
 void	destroy_mutexes(t_data *data);
 void	destroy_forks(t_data *data);
 
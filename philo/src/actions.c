@@ -43,16 +43,16 @@ void philo_take_forks(t_philo *philo)
 	right = philo->id % philo->data->num_philos;
 	if (philo->id % 2 == 0)
 	{
-		pthread_mutex_lock(&philo->data->forks[left]);
+		lock_fork(philo, left, FORK_LEFT);
 		print_status(philo, "has taken a fork");
-		pthread_mutex_lock(&philo->data->forks[right]);
+		lock_fork(philo, right, FORK_RIGHT);
 		print_status(philo, "has taken a fork");
 	}
 	else
 	{
-		pthread_mutex_lock(&philo->data->forks[right]);
+		lock_fork(philo, right, FORK_RIGHT);
 		print_status(philo, "has taken a fork");
-		pthread_mutex_lock(&philo->data->forks[left]);
+		lock_fork(philo, left, FORK_LEFT);
 		print_status(philo, "has taken a fork");
 	}
 }
@@ -61,7 +61,7 @@ void philo_eat(t_philo *philo)
 {
 	philo_take_forks(philo);
 	print_status(philo, "is eating");
-	pthread_mutex_lock(&philo->meal_mutex);
+	mutex_lock(&philo->meal_mutex);
 	philo->last_meal_time = get_time_ms();
 	philo->meals_eaten++;
 	pthread_mutex_unlock(&philo->meal_mutex);
@@ -24,7 +24,8 @@ void	destroy_forks(t_data *data)
 			pthread_mutex_destroy(&data->forks[i]);
 			i++;
 		}
-		free(data->forks);
+		table_free(data, data->forks,
+			sizeof(pthread_mutex_t) * data->num_philos);
 	}
 }
 
@@ -47,9 +48,15 @@ void	destroy_mutexes(t_data *data)
 	destroy_forks(data);
 }
 
-void	cleanup(t_data *data)
+int	cleanup(t_data *data)
 {
+	int	saved;
+
+	sink_destroy(data);
+	saved = trace_save(data);
+	trace_free(data);
 	destroy_mutexes(data);
 	if (data->philos)
-		free(data->philos);
+		table_free(data, data->philos, sizeof(t_philo) * data->num_philos);
+	return (saved);
 }
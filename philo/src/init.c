@@ -16,17 +16,18 @@ static int init_forks(t_data *data)
 {
 	int i;
 
-	data->forks = malloc(sizeof(pthread_mutex_t) * data->num_philos);
+	data->forks = table_alloc(data, sizeof(pthread_mutex_t) * data->num_philos);
 	if (!data->forks)
 		return (0);
 	i = 0;
 	while (i < data->num_philos)
 	{
-		if (pthread_mutex_init(&data->forks[i], NULL) != 0)
+		if (mutex_init(data, &data->forks[i]) != 0)
 		{
 			while (--i >= 0)
 				pthread_mutex_destroy(&data->forks[i]);
-			free(data->forks);
+			table_free(data, data->forks,
+				sizeof(pthread_mutex_t) * data->num_philos);
 			return (0);
 		}
 		i++;
@@ -38,18 +39,18 @@ int	init_mutexes(t_data *data)
 {
 	if (!init_forks(data))
 		return (0);
-	if (pthread_mutex_init(&data->print_mutex, NULL) != 0)
+	if (mutex_init(data, &data->print_mutex) != 0)
 	{
 		destroy_forks(data);
 		return (0);
 	}
-	if (pthread_mutex_init(&data->death_mutex, NULL) != 0)
+	if (mutex_init(data, &data->death_mutex) != 0)
 	{
 		pthread_mutex_destroy(&data->print_mutex);
 		destroy_forks(data);
 		return (0);
 	}
-	if (pthread_mutex_init(&data->meal_check_mutex, NULL) != 0)
+	if (mutex_init(data, &data->meal_check_mutex) != 0)
 	{
 		pthread_mutex_destroy(&data->death_mutex);
 		pthread_mutex_destroy(&data->print_mutex);
@@ -64,6 +65,7 @@ static void config_philo(t_data *data, int i)
 	data->philos[i].id = i + 1;
 	data->philos[i].meals_eaten = 0;
 	data->philos[i].last_meal_time = 0;
+	data->philos[i].pid = 0;
 	data->philos[i].data = data;
 }
 
@@ -71,18 +73,18 @@ int init_philos(t_data *data)
 {
 	int i;
 
-	data->philos = malloc(sizeof(t_philo) * data->num_philos);
+	data->philos = table_alloc(data, sizeof(t_philo) * data->num_philos);
 	if (!data->philos)
 		return (0);
 	i = 0;
 	while (i < data->num_philos)
 	{
 		config_philo(data, i);
-		if (pthread_mutex_init(&data->philos[i].meal_mutex, NULL) != 0)
+		if (mutex_init(data, &data->philos[i].meal_mutex) != 0)
 		{
 			while (--i >= 0)
 				pthread_mutex_destroy(&data->philos[i].meal_mutex);
-			free(data->philos);
+			table_free(data, data->philos, sizeof(t_philo) * data->num_philos);
 			return (0);
 		}
 		i++;
@@ -94,11 +96,24 @@ int init_data(t_data *data)
 {
 	data->someone_died = 0;
 	data->all_ate_flag = 0;
+	if (!trace_init(data))
+		return (0);
 	if (!init_mutexes(data))
+	{
+		trace_free(data);
 		return (0);
+	}
 	if (!init_philos(data))
 	{
 		destroy_mutexes(data);
+		trace_free(data);
+		return (0);
+	}
+	if (!sink_init(data))
+	{
+		destroy_mutexes(data);
+		table_free(data, data->philos, sizeof(t_philo) * data->num_philos);
+		trace_free(data);
 		return (0);
 	}
 	return (1);
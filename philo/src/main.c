@@ -19,75 +19,39 @@ static void print_usage(void)
 	printf("[times_each_philo_must_eat]\n");
 }
 
-static int create_philos(t_data *data)
+static char	*run_table(t_data *data)
 {
-	int i;
-
-	i = 0;
-	while (i < data->num_philos)
-	{
-		if (pthread_create(&data->philos[i].thread,
-						   NULL, philo_routine, &data->philos[i]) != 0)
-		{
-			pthread_mutex_lock(&data->death_mutex);
-			data->someone_died = 1;
-			pthread_mutex_unlock(&data->death_mutex);
-			return (0);
-		}
-		i++;
-	}
-	return (1);
-}
-
-static int create_threads(t_data *data, pthread_t *monitor)
-{
-	data->start_time = get_time_ms();
-	if (!create_philos(data))
-		return (0);
-	if (pthread_create(monitor, NULL, monitor_routine, data) != 0)
-	{
-		pthread_mutex_lock(&data->death_mutex);
-		data->someone_died = 1;
-		pthread_mutex_unlock(&data->death_mutex);
-		return (0);
-	}
-	return (1);
-}
-
-static void wait_threads(t_data *data, pthread_t monitor)
-{
-	int i;
-
-	pthread_join(monitor, NULL);
-	i = 0;
-	while (i < data->num_philos)
-	{
-		pthread_join(data->philos[i].thread, NULL);
-		i++;
-	}
+	if (data->shared && !run_processes(data))
+		return ("Process creation failed");
+	if (!data->shared && !run_threads(data))
+		return ("Thread creation failed");
+	return (NULL);
 }
 
 int main(int argc, char **argv)
 {
-	t_data		data;
-	pthread_t	monitor;
+	t_data	parsed;
+	t_data	*data;
+	char	*err;
+	int		status;
 
 	if (argc < 5 || argc > 6)
 	{
 		print_usage();
 		return (error_exit("Invalid number of arguments"));
 	}
-	if (!parse_arguments(argc, argv, &data))
+	if (!parse_arguments(argc, argv, &parsed))
 		return (error_exit("Invalid arguments"));
-	if (!init_data(&data))
-		return (error_exit("Initialization failed"));
-	if (!create_threads(&data, &monitor))
+	data = table_create(&parsed);
+	if (!data || !init_data(data))
 	{
-		wait_threads(&data, monitor);
-		cleanup(&data);
-		return (error_exit("Thread creation failed"));
+		table_release(data);
+		return (error_exit("Initialization failed"));
 	}
-	wait_threads(&data, monitor);
-	cleanup(&data);
-	return (0);
+	err = run_table(data);
+	status = !cleanup(data);
+	table_release(data);
+	if (err)
+		return (error_exit(err));
+	return (status);
 }
@@ -16,7 +16,7 @@ int simulation_should_stop(t_data *data)
 {
 	int should_stop;
 
-	pthread_mutex_lock(&data->death_mutex);
+	mutex_lock(&data->death_mutex);
 	should_stop = data->someone_died;
 	pthread_mutex_unlock(&data->death_mutex);
 	return (should_stop);
@@ -26,20 +26,22 @@ static int	check_philosopher_death(t_philo *philo)
 {
 	long current_time;
 	long time_since_meal;
+	char line[LINE_SIZE];
 
-	pthread_mutex_lock(&philo->meal_mutex);
+	mutex_lock(&philo->meal_mutex);
 	current_time = get_time_ms();
 	time_since_meal = current_time - philo->last_meal_time;
 	pthread_mutex_unlock(&philo->meal_mutex);
 	if (time_since_meal >= philo->data->time_to_die)
 	{
-		pthread_mutex_lock(&philo->data->death_mutex);
+		mutex_lock(&philo->data->death_mutex);
 		philo->data->someone_died = 1;
 		pthread_mutex_unlock(&philo->data->death_mutex);
-		pthread_mutex_lock(&philo->data->print_mutex);
-		printf("%ld %d died\n", get_time_ms() - philo->data->start_time,
-			philo->id);
+		mutex_lock(&philo->data->print_mutex);
+		sink_append(philo->data, line, build_line(line,
+				get_time_ms() - philo->data->start_time, philo->id, "died"), 1);
 		pthread_mutex_unlock(&philo->data->print_mutex);
+		sink_flush(philo->data);
 		return (1);
 	}
 	return (0);
@@ -70,7 +72,7 @@ int check_all_ate(t_data *data)
 	i = 0;
 	while (i < data->num_philos)
 	{
-		pthread_mutex_lock(&data->philos[i].meal_mutex);
+		mutex_lock(&data->philos[i].meal_mutex);
 		if (data->philos[i].meals_eaten < data->must_eat_count)
 			all_done = 0;
 		pthread_mutex_unlock(&data->philos[i].meal_mutex);
@@ -78,7 +80,7 @@ int check_all_ate(t_data *data)
 	}
 	if (all_done)
 	{
-		pthread_mutex_lock(&data->death_mutex);
+		mutex_lock(&data->death_mutex);
 		data->someone_died = 1;
 		pthread_mutex_unlock(&data->death_mutex);
 	}
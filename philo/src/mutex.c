@@ -0,0 +1,56 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mutex.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: loda-sil <loda-sil@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:05:00 by loda-sil          #+#    #+#             */
+/*   Updated: 2026/10/19 13:05:00 by loda-sil         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+int	mutex_init(t_data *data, pthread_mutex_t *mutex)
+{
+	pthread_mutexattr_t	attr;
+	int					ret;
+
+	if (!data->shared)
+		return (pthread_mutex_init(mutex, NULL));
+	if (pthread_mutexattr_init(&attr) != 0)
+		return (1);
+	pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+	pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST);
+	ret = pthread_mutex_init(mutex, &attr);
+	pthread_mutexattr_destroy(&attr);
+	return (ret);
+}
+
+int	cond_init(t_data *data, pthread_cond_t *cond)
+{
+	pthread_condattr_t	attr;
+	int					ret;
+
+	if (!data->shared)
+		return (pthread_cond_init(cond, NULL));
+	if (pthread_condattr_init(&attr) != 0)
+		return (1);
+	pthread_condattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+	ret = pthread_cond_init(cond, &attr);
+	pthread_condattr_destroy(&attr);
+	return (ret);
+}
+
+void	mutex_lock(pthread_mutex_t *mutex)
+{
+	if (pthread_mutex_lock(mutex) == EOWNERDEAD)
+		pthread_mutex_consistent(mutex);
+}
+
+void	cond_wait(pthread_cond_t *cond, pthread_mutex_t *mutex)
+{
+	if (pthread_cond_wait(cond, mutex) == EOWNERDEAD)
+		pthread_mutex_consistent(mutex);
+}
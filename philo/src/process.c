@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   process.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: loda-sil <loda-sil@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:05:00 by loda-sil          #+#    #+#             */
+/*   Updated: 2026/10/19 13:05:00 by loda-sil         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static int	spawn_philos(t_data *data)
+{
+	int		i;
+	pid_t	pid;
+
+	i = 0;
+	while (i < data->num_philos)
+	{
+		pid = fork();
+		if (pid < 0)
+		{
+			mutex_lock(&data->death_mutex);
+			data->someone_died = 1;
+			pthread_mutex_unlock(&data->death_mutex);
+			return (0);
+		}
+		if (pid == 0)
+		{
+			philo_routine(&data->philos[i]);
+			_exit(0);
+		}
+		data->philos[i].pid = pid;
+		i++;
+	}
+	return (1);
+}
+
+static void	wait_philos(t_data *data)
+{
+	int	i;
+
+	i = 0;
+	while (i < data->num_philos)
+	{
+		if (data->philos[i].pid > 0)
+			waitpid(data->philos[i].pid, NULL, 0);
+		i++;
+	}
+}
+
+int	run_processes(t_data *data)
+{
+	int	i;
+
+	data->start_time = get_time_ms();
+	i = 0;
+	while (i < data->num_philos)
+		data->philos[i++].last_meal_time = data->start_time;
+	if (!spawn_philos(data))
+	{
+		wait_philos(data);
+		return (0);
+	}
+	monitor_routine(data);
+	wait_philos(data);
+	return (1);
+}
@@ -14,7 +14,7 @@
 
 static void init_philo_time(t_philo *philo)
 {
-	pthread_mutex_lock(&philo->meal_mutex);
+	mutex_lock(&philo->meal_mutex);
 	philo->last_meal_time = philo->data->start_time;
 	pthread_mutex_unlock(&philo->meal_mutex);
 }
@@ -36,7 +36,7 @@ static int	check_meal_limit(t_philo *philo)
 
 	if (philo->data->must_eat_count == -1)
 		return (0);
-	pthread_mutex_lock(&philo->meal_mutex);
+	mutex_lock(&philo->meal_mutex);
 	done = (philo->meals_eaten >= philo->data->must_eat_count);
 	pthread_mutex_unlock(&philo->meal_mutex);
 	return (done);
@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shared.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: loda-sil <loda-sil@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:05:00 by loda-sil          #+#    #+#             */
+/*   Updated: 2026/10/19 13:05:00 by loda-sil         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+t_data	*table_create(t_data *parsed)
+{
+	t_data	*data;
+	char	*mode;
+
+	parsed->shared = 0;
+	mode = getenv("PHILO_PROCESSES");
+	if (!mode || strcmp(mode, "1") != 0)
+		return (parsed);
+	data = mmap(NULL, sizeof(t_data), PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (data == MAP_FAILED)
+		return (NULL);
+	memcpy(data, parsed, sizeof(t_data));
+	data->shared = 1;
+	return (data);
+}
+
+void	table_release(t_data *data)
+{
+	if (data && data->shared)
+		munmap(data, sizeof(t_data));
+}
+
+void	*table_alloc(t_data *data, size_t size)
+{
+	void	*ptr;
+
+	if (!data->shared)
+		return (malloc(size));
+	ptr = mmap(NULL, size, PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (ptr == MAP_FAILED)
+		return (NULL);
+	return (ptr);
+}
+
+void	table_free(t_data *data, void *ptr, size_t size)
+{
+	if (!data->shared)
+		free(ptr);
+	else
+		munmap(ptr, size);
+}
@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sink.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: loda-sil <loda-sil@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by loda-sil          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by loda-sil         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static void	write_all(t_sink *sink, char *buf, size_t len)
+{
+	ssize_t	ret;
+
+	while (len > 0)
+	{
+		ret = -1;
+		if (sink->ring.fd >= 0)
+			ret = uring_write(&sink->ring, buf, len);
+		if (ret < 0 && sink->ring.fd >= 0)
+			uring_destroy(&sink->ring);
+		if (ret < 0)
+			ret = write(STDOUT_FILENO, buf, len);
+		if (ret <= 0)
+			return ;
+		buf += ret;
+		len -= ret;
+	}
+}
+
+static void	write_active(t_data *data)
+{
+	t_sink	*sink;
+	int		idx;
+
+	sink = &data->sink;
+	idx = sink->active;
+	sink->active = !idx;
+	sink->writing = 1;
+	pthread_mutex_unlock(&data->print_mutex);
+	write_all(sink, sink->buf[idx], sink->len[idx]);
+	mutex_lock(&data->print_mutex);
+	sink->len[idx] = 0;
+	sink->writing = 0;
+	pthread_cond_broadcast(&sink->drained);
+}
+
+static void	*sink_routine(void *arg)
+{
+	t_data	*data;
+	t_sink	*sink;
+
+	data = (t_data *)arg;
+	sink = &data->sink;
+	mutex_lock(&data->print_mutex);
+	while (sink->len[sink->active] > 0 || !sink->stop)
+	{
+		if (sink->len[sink->active] == 0)
+			cond_wait(&sink->ready, &data->print_mutex);
+		else
+			write_active(data);
+	}
+	pthread_mutex_unlock(&data->print_mutex);
+	return (NULL);
+}
+
+static int	start_writer(t_data *data)
+{
+	t_sink	*sink;
+
+	sink = &data->sink;
+	if (cond_init(data, &sink->ready) != 0)
+		return (0);
+	if (cond_init(data, &sink->drained) != 0)
+	{
+		pthread_cond_destroy(&sink->ready);
+		return (0);
+	}
+	if (pthread_create(&sink->thread, NULL, sink_routine, data) != 0)
+	{
+		pthread_cond_destroy(&sink->drained);
+		pthread_cond_destroy(&sink->ready);
+		return (0);
+	}
+	return (1);
+}
+
+int	sink_init(t_data *data)
+{
+	t_sink	*sink;
+
+	sink = &data->sink;
+	sink->len[0] = 0;
+	sink->len[1] = 0;
+	sink->active = 0;
+	sink->writing = 0;
+	sink->stop = 0;
+	sink->dropped = 0;
+	uring_init(&sink->ring);
+	if (!start_writer(data))
+	{
+		uring_destroy(&sink->ring);
+		return (0);
+	}
+	return (1);
+}
@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sink_utils.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: loda-sil <loda-sil@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by loda-sil          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by loda-sil         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static int	put_number(char *dst, long n)
+{
+	char	tmp[20];
+	int		len;
+	int		i;
+
+	len = 0;
+	tmp[len++] = '0' + n % 10;
+	n /= 10;
+	while (n > 0)
+	{
+		tmp[len++] = '0' + n % 10;
+		n /= 10;
+	}
+	i = 0;
+	while (i < len)
+	{
+		dst[i] = tmp[len - 1 - i];
+		i++;
+	}
+	return (len);
+}
+
+int	build_line(char *line, long timestamp, int id, char *status)
+{
+	int	len;
+	int	i;
+
+	len = put_number(line, timestamp);
+	line[len++] = ' ';
+	len += put_number(line + len, id);
+	line[len++] = ' ';
+	i = 0;
+	while (status[i] && len < LINE_SIZE - 1)
+		line[len++] = status[i++];
+	line[len++] = '\n';
+	return (len);
+}
+
+/*
+** Never waits for the writer: a philosopher may be holding forks here.
+** When both buffers are full the line is dropped and counted instead.
+** The death line uses the LINE_SIZE reserved at the end of each buffer.
+*/
+void	sink_append(t_data *data, char *line, int len, int reserved)
+{
+	t_sink	*sink;
+	size_t	limit;
+
+	sink = &data->sink;
+	limit = SINK_SIZE;
+	if (reserved)
+		limit += LINE_SIZE;
+	if (sink->len[sink->active] + len > limit)
+	{
+		sink->dropped++;
+		return ;
+	}
+	memcpy(sink->buf[sink->active] + sink->len[sink->active], line, len);
+	sink->len[sink->active] += len;
+	if (!sink->writing)
+		pthread_cond_signal(&sink->ready);
+}
+
+void	sink_flush(t_data *data)
+{
+	t_sink	*sink;
+
+	sink = &data->sink;
+	mutex_lock(&data->print_mutex);
+	while (sink->len[sink->active] > 0 || sink->writing)
+	{
+		pthread_cond_signal(&sink->ready);
+		cond_wait(&sink->drained, &data->print_mutex);
+	}
+	pthread_mutex_unlock(&data->print_mutex);
+}
+
+void	sink_destroy(t_data *data)
+{
+	mutex_lock(&data->print_mutex);
+	data->sink.stop = 1;
+	pthread_cond_signal(&data->sink.ready);
+	pthread_mutex_unlock(&data->print_mutex);
+	pthread_join(data->sink.thread, NULL);
+	if (data->sink.dropped > 0)
+		fprintf(stderr, "Warning: %ld status lines dropped (stdout too slow)\n",
+			data->sink.dropped);
+	pthread_cond_destroy(&data->sink.drained);
+	pthread_cond_destroy(&data->sink.ready);
+	uring_destroy(&data->sink.ring);
+}
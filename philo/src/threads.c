@@ -0,0 +1,65 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   threads.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: loda-sil <loda-sil@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 18:40:00 by loda-sil          #+#    #+#             */
+/*   Updated: 2026/10/19 18:40:00 by loda-sil         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static int create_philos(t_data *data)
+{
+	int i;
+
+	i = 0;
+	while (i < data->num_philos)
+	{
+		if (pthread_create(&data->philos[i].thread,
+						   NULL, philo_routine, &data->philos[i]) != 0)
+		{
+			mutex_lock(&data->death_mutex);
+			data->someone_died = 1;
+			pthread_mutex_unlock(&data->death_mutex);
+			return (0);
+		}
+		i++;
+	}
+	return (1);
+}
+
+static int create_threads(t_data *data, pthread_t *monitor)
+{
+	data->start_time = get_time_ms();
+	if (!create_philos(data))
+		return (0);
+	if (pthread_create(monitor, NULL, monitor_routine, data) != 0)
+	{
+		mutex_lock(&data->death_mutex);
+		data->someone_died = 1;
+		pthread_mutex_unlock(&data->death_mutex);
+		return (0);
+	}
+	return (1);
+}
+
+int	run_threads(t_data *data)
+{
+	pthread_t	monitor;
+	int			ok;
+	int			i;
+
+	ok = create_threads(data, &monitor);
+	pthread_join(monitor, NULL);
+	i = 0;
+	while (i < data->num_philos)
+	{
+		pthread_join(data->philos[i].thread, NULL);
+		i++;
+	}
+	return (ok);
+}
@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: loda-sil <loda-sil@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by loda-sil          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by loda-sil         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static int	read_log(FILE *file, t_fork_log *log)
+{
+	size_t	bytes;
+	size_t	i;
+
+	if (fscanf(file, "%zu", &log->count) != 1)
+		return (0);
+	bytes = (log->count + 7) / 8;
+	log->cap = bytes + 1;
+	log->bits = malloc(log->cap);
+	if (!log->bits)
+		return (0);
+	i = 0;
+	while (i < bytes)
+	{
+		if (fscanf(file, "%2hhx", &log->bits[i]) != 1)
+			return (0);
+		i++;
+	}
+	return (1);
+}
+
+static int	trace_load(t_data *data)
+{
+	FILE	*file;
+	size_t	forks;
+	char	*err;
+	int		i;
+
+	err = NULL;
+	file = fopen(data->trace_path, "r");
+	if (!file)
+		err = "Cannot open replay trace";
+	else if (fscanf(file, "%zu", &forks) != 1)
+		err = "Replay trace is corrupt";
+	else if (forks != (size_t)data->num_philos)
+		err = "Replay trace has a different number of philosophers";
+	i = 0;
+	while (!err && i < data->num_philos && read_log(file, &data->logs[i]))
+		i++;
+	if (!err && i < data->num_philos)
+		err = "Replay trace is corrupt or truncated";
+	if (file)
+		fclose(file);
+	if (err)
+		error_exit(err);
+	return (err == NULL);
+}
+
+static int	pick_mode(t_data *data)
+{
+	char	*record;
+	char	*replay;
+
+	record = getenv("PHILO_RECORD");
+	replay = getenv("PHILO_REPLAY");
+	if (record && replay)
+	{
+		error_exit("PHILO_RECORD and PHILO_REPLAY cannot be combined");
+		return (0);
+	}
+	if ((record || replay) && data->shared)
+	{
+		error_exit("Fork traces are not available in process mode");
+		return (0);
+	}
+	data->trace_path = record;
+	if (record)
+		data->trace_mode = TRACE_RECORD;
+	if (replay)
+		data->trace_mode = TRACE_REPLAY;
+	if (replay)
+		data->trace_path = replay;
+	return (1);
+}
+
+int	trace_init(t_data *data)
+{
+	data->trace_mode = TRACE_OFF;
+	data->logs = NULL;
+	if (!pick_mode(data))
+		return (0);
+	if (data->trace_mode == TRACE_OFF)
+		return (1);
+	data->logs = malloc(sizeof(t_fork_log) * data->num_philos);
+	if (!data->logs)
+		return (0);
+	memset(data->logs, 0, sizeof(t_fork_log) * data->num_philos);
+	if (data->trace_mode == TRACE_REPLAY && !trace_load(data))
+	{
+		trace_free(data);
+		return (0);
+	}
+	return (1);
+}
+
+void	trace_free(t_data *data)
+{
+	int	i;
+
+	if (!data->logs)
+		return ;
+	i = 0;
+	while (i < data->num_philos)
+	{
+		free(data->logs[i].bits);
+		i++;
+	}
+	free(data->logs);
+	data->logs = NULL;
+}
@@ -0,0 +1,76 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace_fork.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: loda-sil <loda-sil@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:20:00 by loda-sil          #+#    #+#             */
+/*   Updated: 2026/10/19 11:20:00 by loda-sil         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static void	log_push(t_fork_log *log, int side)
+{
+	unsigned char	*bits;
+
+	if (log->failed)
+		return ;
+	if (log->count / 8 >= log->cap)
+	{
+		bits = malloc(log->cap * 2 + 64);
+		if (!bits)
+		{
+			log->failed = 1;
+			return ;
+		}
+		memset(bits, 0, log->cap * 2 + 64);
+		if (log->bits)
+			memcpy(bits, log->bits, log->cap);
+		free(log->bits);
+		log->bits = bits;
+		log->cap = log->cap * 2 + 64;
+	}
+	if (side == FORK_RIGHT)
+		log->bits[log->count / 8] |= 1 << (log->count % 8);
+	log->count++;
+}
+
+static int	log_next(t_fork_log *log)
+{
+	return ((log->bits[log->cursor / 8] >> (log->cursor % 8)) & 1);
+}
+
+static void	wait_turn(t_philo *philo, int fork, int side)
+{
+	t_fork_log	*log;
+
+	log = &philo->data->logs[fork];
+	while (1)
+	{
+		mutex_lock(&philo->data->forks[fork]);
+		if (log->cursor >= log->count)
+			return ;
+		if (log_next(log) == side)
+		{
+			log->cursor++;
+			return ;
+		}
+		if (simulation_should_stop(philo->data))
+			return ;
+		pthread_mutex_unlock(&philo->data->forks[fork]);
+		usleep(100);
+	}
+}
+
+void	lock_fork(t_philo *philo, int fork, int side)
+{
+	if (philo->data->trace_mode == TRACE_REPLAY)
+		wait_turn(philo, fork, side);
+	else
+		mutex_lock(&philo->data->forks[fork]);
+	if (philo->data->trace_mode == TRACE_RECORD)
+		log_push(&philo->data->logs[fork], side);
+}
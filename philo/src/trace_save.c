@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace_save.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: loda-sil <loda-sil@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 18:40:00 by loda-sil          #+#    #+#             */
+/*   Updated: 2026/10/19 18:40:00 by loda-sil         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static int	trace_complete(t_data *data)
+{
+	int	i;
+
+	i = 0;
+	while (i < data->num_philos)
+	{
+		if (data->logs[i].failed)
+			return (0);
+		i++;
+	}
+	return (1);
+}
+
+static void	write_log(FILE *file, t_fork_log *log)
+{
+	size_t	j;
+
+	fprintf(file, "%zu ", log->count);
+	j = 0;
+	while (j < (log->count + 7) / 8)
+		fprintf(file, "%02x", log->bits[j++]);
+	fprintf(file, "\n");
+}
+
+int	trace_save(t_data *data)
+{
+	FILE	*file;
+	int		i;
+
+	if (data->trace_mode != TRACE_RECORD)
+		return (1);
+	if (!trace_complete(data))
+	{
+		error_exit("Fork trace incomplete (out of memory), not written");
+		return (0);
+	}
+	file = fopen(data->trace_path, "w");
+	if (file)
+	{
+		fprintf(file, "%d\n", data->num_philos);
+		i = 0;
+		while (i < data->num_philos)
+			write_log(file, &data->logs[i++]);
+	}
+	if (!file || fclose(file) != 0)
+	{
+		error_exit("Could not write fork trace");
+		return (0);
+	}
+	return (1);
+}
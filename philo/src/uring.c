@@ -0,0 +1,118 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   uring.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: loda-sil <loda-sil@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by loda-sil          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by loda-sil         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static void	*map_ring(int fd, size_t size, off_t offset)
+{
+	void	*ptr;
+
+	ptr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+			fd, offset);
+	if (ptr == MAP_FAILED)
+		return (NULL);
+	return (ptr);
+}
+
+static void	set_offsets(t_uring *ring, struct io_uring_params *p)
+{
+	char	*sq;
+	char	*cq;
+
+	sq = (char *)ring->sq_ring;
+	cq = (char *)ring->cq_ring;
+	ring->sq_tail = (unsigned int *)(sq + p->sq_off.tail);
+	ring->sq_mask = (unsigned int *)(sq + p->sq_off.ring_mask);
+	ring->sq_array = (unsigned int *)(sq + p->sq_off.array);
+	ring->cq_head = (unsigned int *)(cq + p->cq_off.head);
+	ring->cq_tail = (unsigned int *)(cq + p->cq_off.tail);
+	ring->cq_mask = (unsigned int *)(cq + p->cq_off.ring_mask);
+	ring->cqes = (struct io_uring_cqe *)(cq + p->cq_off.cqes);
+}
+
+/*
+** Runtime probe: without io_uring (old kernel, seccomp, sysctl) the ring
+** keeps fd -1 and the writer thread falls back to write().
+*/
+int	uring_init(t_uring *ring)
+{
+	struct io_uring_params	p;
+
+	memset(ring, 0, sizeof(t_uring));
+	memset(&p, 0, sizeof(p));
+	ring->fd = syscall(SYS_io_uring_setup, 2, &p);
+	if (ring->fd < 0)
+	{
+		ring->fd = -1;
+		return (0);
+	}
+	ring->sq_size = p.sq_off.array + p.sq_entries * sizeof(unsigned int);
+	ring->cq_size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+	ring->sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+	ring->sq_ring = map_ring(ring->fd, ring->sq_size, IORING_OFF_SQ_RING);
+	ring->cq_ring = map_ring(ring->fd, ring->cq_size, IORING_OFF_CQ_RING);
+	ring->sqes = map_ring(ring->fd, ring->sqes_size, IORING_OFF_SQES);
+	if (!ring->sq_ring || !ring->cq_ring || !ring->sqes)
+	{
+		uring_destroy(ring);
+		return (0);
+	}
+	set_offsets(ring, &p);
+	return (1);
+}
+
+/*
+** Returns the byte count or a negative value; on any failure the caller
+** drops the ring and retries the same bytes with write().
+*/
+ssize_t	uring_write(t_uring *ring, char *buf, size_t len)
+{
+	struct io_uring_sqe	*sqe;
+	unsigned int		tail;
+	unsigned int		head;
+	int					res;
+
+	tail = *ring->sq_tail;
+	sqe = &ring->sqes[tail & *ring->sq_mask];
+	memset(sqe, 0, sizeof(*sqe));
+	sqe->opcode = IORING_OP_WRITE;
+	sqe->fd = STDOUT_FILENO;
+	sqe->addr = (unsigned long)buf;
+	sqe->len = len;
+	sqe->off = (__u64)-1;
+	ring->sq_array[tail & *ring->sq_mask] = tail & *ring->sq_mask;
+	__atomic_store_n(ring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+	if (syscall(SYS_io_uring_enter, ring->fd, 1, 1,
+			IORING_ENTER_GETEVENTS, NULL, 0) < 0)
+		return (-1);
+	head = *ring->cq_head;
+	while (head == __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE))
+		syscall(SYS_io_uring_enter, ring->fd, 0, 1,
+			IORING_ENTER_GETEVENTS, NULL, 0);
+	res = ring->cqes[head & *ring->cq_mask].res;
+	__atomic_store_n(ring->cq_head, head + 1, __ATOMIC_RELEASE);
+	return (res);
+}
+
+void	uring_destroy(t_uring *ring)
+{
+	if (ring->sqes)
+		munmap(ring->sqes, ring->sqes_size);
+	if (ring->cq_ring)
+		munmap(ring->cq_ring, ring->cq_size);
+	if (ring->sq_ring)
+		munmap(ring->sq_ring, ring->sq_size);
+	if (ring->fd >= 0)
+		close(ring->fd);
+	memset(ring, 0, sizeof(t_uring));
+	ring->fd = -1;
+}
@@ -49,16 +49,20 @@ void	smart_sleep(long milliseconds)
 
 void	print_status(t_philo *philo, char *status)
 {
-	long	timestamp;
+	char	line[LINE_SIZE];
+	int		len;
+	int		died;
 
-	pthread_mutex_lock(&philo->data->print_mutex);
-	pthread_mutex_lock(&philo->data->death_mutex);
-	if (!philo->data->someone_died)
+	mutex_lock(&philo->data->print_mutex);
+	mutex_lock(&philo->data->death_mutex);
+	died = philo->data->someone_died;
+	pthread_mutex_unlock(&philo->data->death_mutex);
+	if (!died)
 	{
-		timestamp = get_time_ms() - philo->data->start_time;
-		printf("%ld %d %s\n", timestamp, philo->id, status);
+		len = build_line(line, get_time_ms() - philo->data->start_time,
+				philo->id, status);
+		sink_append(philo->data, line, len, 0);
 	}
-	pthread_mutex_unlock(&philo->data->death_mutex);
 	pthread_mutex_unlock(&philo->data->print_mutex);
 }
 